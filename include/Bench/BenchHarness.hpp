@@ -0,0 +1,72 @@
+#pragma once
+#include "nlohmann/json.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+struct BenchResult {
+    std::string name;
+    std::string unit;
+    size_t samples = 0;
+    double median = 0.0;
+    double ciLow = 0.0; // 95% confidence interval of the median
+    double ciHigh = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double tolerance = 0.0; // absolute slack, in `unit`, allowed on top of the relative threshold
+};
+
+struct BenchOptions {
+    int warmupSamples = 5;
+    int samples = 31;
+    double minSampleMs = 5.0; // batch size is grown until one sample takes at least this long
+    std::string filter;       // only run benchmarks whose name contains this
+};
+
+class BenchHarness {
+  public:
+    explicit BenchHarness(const BenchOptions &options);
+
+    // Times `body(iterations)` and reports nanoseconds per iteration. The body owns the loop so the harness adds no
+    // per-iteration call overhead. `setup`, if given, runs untimed before every batch so stateful workloads can start
+    // each sample from the same state.
+    void run(const std::string &name, const std::function<void(uint64_t iterations)> &body,
+             const std::function<void()> &setup = nullptr);
+    // For benchmarks that are not a throughput loop: each call of `sample` returns one measurement in `unit`.
+    // `tolerance` is for quantities whose baseline is close to zero, where any relative threshold is just noise.
+    void runMeasured(const std::string &name, const std::string &unit, const std::function<double()> &sample,
+                     double tolerance = 0.0);
+
+    const std::vector<BenchResult> &getResults() const {
+        return results;
+    }
+    nlohmann::json toJson() const;
+
+  private:
+    bool isSelected(const std::string &name) const;
+    void record(const std::string &name, const std::string &unit, std::vector<double> samples, double tolerance);
+
+    BenchOptions options;
+    std::vector<BenchResult> results;
+};
+
+// Pins the calling thread to one CPU core. Returns false where unsupported or when the core does not exist.
+bool pinThreadToCore(int core);
+// CPU time consumed by the calling thread so far, in microseconds.
+double threadCpuTimeUs();
+
+struct BenchRegression {
+    std::string name;
+    double baselineMedian;
+    double currentMedian;
+};
+
+// A benchmark regresses when its median grew by more than `threshold` (0.10 = 10%) of the baseline median plus its
+// tolerance. Benchmarks absent from the baseline are skipped.
+std::vector<BenchRegression> compareToBaseline(const nlohmann::json &baseline, const std::vector<BenchResult> &results,
+                                               double threshold);
+
+} // namespace Bench
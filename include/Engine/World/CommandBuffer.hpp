@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine::World {
+
+// A write that crosses a region boundary. Recorded while regions update in parallel and applied later, on a single
+// thread, during the commit phase.
+struct WorldCommand {
+    uint32_t fromTile; // index of the tile giving up an item
+    uint32_t toTile;   // index of the tile receiving it
+};
+
+class CommandBuffer {
+  public:
+    void pushTransfer(uint32_t fromTile, uint32_t toTile) {
+        commands.push_back({fromTile, toTile});
+    }
+    void clear() {
+        commands.clear();
+    }
+    bool empty() const {
+        return commands.empty();
+    }
+    size_t size() const {
+        return commands.size();
+    }
+    const std::vector<WorldCommand> &getCommands() const {
+        return commands;
+    }
+
+  private:
+    std::vector<WorldCommand> commands;
+};
+
+} // namespace Engine::World
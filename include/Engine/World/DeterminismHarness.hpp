@@ -0,0 +1,30 @@
+#pragma once
+#include "Engine/World/World.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Engine::World {
+
+// Fills the world with a pseudo-random mix of miners, belts and chests. The layout depends only on the seed.
+void buildSyntheticFactory(World &world, uint32_t seed);
+
+struct DeterminismResult {
+    unsigned threadCount;
+    uint64_t stateHash;
+    double elapsedMs;
+};
+
+struct DeterminismConfig {
+    int width = 256;
+    int height = 256;
+    int regionSize = 32;
+    int ticks = 200;
+    uint32_t seed = 1;
+    std::vector<unsigned> threadCounts = {1, 2, 4, 8};
+};
+
+// Simulates the same synthetic factory once per thread count and records the final state hash of each run.
+std::vector<DeterminismResult> runDeterminismCheck(const DeterminismConfig &config);
+bool hashesMatch(const std::vector<DeterminismResult> &results);
+
+} // namespace Engine::World
@@ -0,0 +1,57 @@
+#pragma once
+#include "Engine/World/CommandBuffer.hpp"
+#include "Engine/World/World.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine::World {
+
+// Runs one world tick in two phases:
+//   1. update: regions are handed out to worker threads (plus the calling thread) and updated in parallel, each
+//      writing cross-region effects into its own CommandBuffer;
+//   2. commit: the calling thread applies every buffer in ascending region order.
+// Because regions never observe each other during phase 1 and phase 2 is serial and ordered, the resulting state is
+// bit-identical for any thread count, including 1.
+class RegionScheduler {
+  public:
+    // threadCount includes the calling thread; 0 picks std::thread::hardware_concurrency().
+    explicit RegionScheduler(unsigned threadCount = 0);
+    ~RegionScheduler();
+
+    RegionScheduler(const RegionScheduler &) = delete;
+    RegionScheduler &operator=(const RegionScheduler &) = delete;
+    RegionScheduler(RegionScheduler &&) = delete;
+    RegionScheduler &operator=(RegionScheduler &&) = delete;
+
+    void tick(World &world);
+    unsigned getThreadCount() const {
+        return static_cast<unsigned>(workers.size()) + 1;
+    }
+    // Cross-region commands applied during the last tick.
+    size_t getLastCommandCount() const {
+        return lastCommandCount;
+    }
+
+  private:
+    void workerLoop();
+    void updateRegions();
+
+    std::vector<std::thread> workers;
+    std::vector<CommandBuffer> commandBuffers;
+
+    std::mutex mutex;
+    std::condition_variable workReady;
+    std::condition_variable workDone;
+    World *activeWorld = nullptr;
+    uint64_t generation = 0;
+    unsigned busyWorkers = 0;
+    bool stopping = false;
+    std::atomic<size_t> nextRegion{0};
+
+    size_t lastCommandCount = 0;
+};
+
+} // namespace Engine::World
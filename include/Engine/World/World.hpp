@@ -0,0 +1,89 @@
+#pragma once
+#include "Engine/World/CommandBuffer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine::World {
+
+enum class EntityKind : uint8_t { Empty, Miner, Belt, Chest };
+enum class Direction : uint8_t { North, East, South, West };
+
+struct Tile {
+    EntityKind kind = EntityKind::Empty;
+    Direction dir = Direction::East;
+    uint16_t items = 0;
+    uint16_t incoming = 0; // items received from inside the same region this tick
+    uint16_t timer = 0;
+};
+
+// Tile grid split into fixed square regions. A region only ever reads and writes its own tiles while it updates;
+// anything that would touch a neighbouring region goes into that region's CommandBuffer instead. Region layout is a
+// property of the world, not of the thread count, so the result of a tick never depends on how many threads ran it.
+class World {
+  public:
+    static constexpr uint16_t MINER_PERIOD = 4; // ticks per mined item
+    static constexpr uint16_t MINER_CAPACITY = 8;
+    static constexpr uint16_t BELT_CAPACITY = 4;
+    static constexpr uint16_t CHEST_CAPACITY = 1000;
+
+    World(int width, int height, int regionSize);
+    ~World() = default;
+
+    int getWidth() const {
+        return width;
+    }
+    int getHeight() const {
+        return height;
+    }
+    int getRegionSize() const {
+        return regionSize;
+    }
+    size_t getRegionCount() const {
+        return static_cast<size_t>(regionsX) * regionsY;
+    }
+    uint64_t getTickCount() const {
+        return tickCount;
+    }
+
+    Tile &getTile(int x, int y) {
+        return tiles[tileIndex(x, y)];
+    }
+    const Tile &getTile(int x, int y) const {
+        return tiles[tileIndex(x, y)];
+    }
+    void setTile(int x, int y, const Tile &tile) {
+        tiles[tileIndex(x, y)] = tile;
+    }
+
+    // Update phase: safe to call concurrently for distinct regions.
+    void updateRegion(size_t region, CommandBuffer &deferred);
+    // Commit phase: must be called on one thread, in ascending region order.
+    void applyCommands(const CommandBuffer &deferred);
+    void endTick() {
+        tickCount++;
+    }
+
+    // FNV-1a over every tile's simulation state plus the tick counter.
+    uint64_t computeStateHash() const;
+
+  private:
+    size_t tileIndex(int x, int y) const {
+        return static_cast<size_t>(y) * width + x;
+    }
+    size_t regionOf(int x, int y) const {
+        return static_cast<size_t>(y / regionSize) * regionsX + x / regionSize;
+    }
+    static uint16_t capacityOf(EntityKind kind);
+    void pushItem(int x, int y, size_t region, CommandBuffer &deferred);
+
+    int width;
+    int height;
+    int regionSize;
+    int regionsX;
+    int regionsY;
+    uint64_t tickCount = 0;
+    std::vector<Tile> tiles;
+};
+
+} // namespace Engine::World
@@ -0,0 +1,175 @@
+#include "Bench/BenchHarness.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#endif
+
+namespace Bench {
+
+BenchHarness::BenchHarness(const BenchOptions &options) : options(options) {};
+
+bool BenchHarness::isSelected(const std::string &name) const {
+    return options.filter.empty() || name.find(options.filter) != std::string::npos;
+}
+
+void BenchHarness::run(const std::string &name, const std::function<void(uint64_t iterations)> &body,
+                       const std::function<void()> &setup) {
+    if (!isSelected(name)) {
+        return;
+    }
+    using clock = std::chrono::steady_clock;
+    auto timeBatch = [&body, &setup](uint64_t iterations) {
+        if (setup) {
+            setup();
+        }
+        auto start = clock::now();
+        body(iterations);
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    };
+
+    // Calibrate the batch size; this doubles as the first part of the warmup.
+    uint64_t iterations = 1;
+    while (timeBatch(iterations) < options.minSampleMs * 1e6 && iterations < (uint64_t(1) << 40)) {
+        iterations *= 2;
+    }
+    for (int i = 0; i < options.warmupSamples; i++) {
+        timeBatch(iterations);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(options.samples);
+    for (int i = 0; i < options.samples; i++) {
+        samples.push_back(timeBatch(iterations) / static_cast<double>(iterations));
+    }
+    record(name, "ns/op", std::move(samples), 0.0);
+}
+
+void BenchHarness::runMeasured(const std::string &name, const std::string &unit, const std::function<double()> &sample,
+                               double tolerance) {
+    if (!isSelected(name)) {
+        return;
+    }
+    for (int i = 0; i < options.warmupSamples; i++) {
+        sample();
+    }
+    std::vector<double> samples;
+    samples.reserve(options.samples);
+    for (int i = 0; i < options.samples; i++) {
+        samples.push_back(sample());
+    }
+    record(name, unit, std::move(samples), tolerance);
+}
+
+void BenchHarness::record(const std::string &name, const std::string &unit, std::vector<double> samples,
+                          double tolerance) {
+    std::sort(samples.begin(), samples.end());
+    const size_t n = samples.size();
+
+    BenchResult result;
+    result.name = name;
+    result.unit = unit;
+    result.samples = n;
+    result.tolerance = tolerance;
+    result.min = samples.front();
+    result.max = samples.back();
+    result.median = n % 2 ? samples[n / 2] : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+
+    // Distribution-free CI of the median: the order statistics at ranks n/2 -+ 1.96*sqrt(n)/2 (normal approximation
+    // of the binomial). Timing samples are skewed, so this is more honest than mean +- stddev.
+    double halfWidth = 1.96 * std::sqrt(static_cast<double>(n)) / 2.0;
+    long lowRank = static_cast<long>(std::floor(n / 2.0 - halfWidth));
+    lowRank = std::clamp(lowRank, 0L, static_cast<long>(n) - 1);
+    result.ciLow = samples[lowRank];
+    result.ciHigh = samples[n - 1 - lowRank];
+    results.push_back(result);
+
+    std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(14) << result.median << " " << std::left << std::setw(6) << unit << std::right << " ["
+              << result.ciLow << ", " << result.ciHigh << "]\n";
+}
+
+nlohmann::json BenchHarness::toJson() const {
+    nlohmann::json benchmarks = nlohmann::json::array();
+    for (const BenchResult &result : results) {
+        benchmarks.push_back({{"name", result.name},
+                              {"unit", result.unit},
+                              {"samples", result.samples},
+                              {"median", result.median},
+                              {"ci_low", result.ciLow},
+                              {"ci_high", result.ciHigh},
+                              {"min", result.min},
+                              {"max", result.max},
+                              {"tolerance", result.tolerance}});
+    }
+    return {{"benchmarks", benchmarks}};
+}
+
+bool pinThreadToCore(int core) {
+    if (core < 0 || static_cast<unsigned>(core) >= std::thread::hardware_concurrency()) {
+        return false;
+    }
+#ifdef _WIN32
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+double threadCpuTimeUs() {
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+        return 0.0;
+    }
+    auto ticks = [](const FILETIME &time) {
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+    return (ticks(kernel) + ticks(user)) / 10.0; // FILETIME counts 100ns intervals
+#else
+    timespec now;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) != 0) {
+        return 0.0;
+    }
+    return now.tv_sec * 1e6 + now.tv_nsec / 1e3;
+#endif
+}
+
+std::vector<BenchRegression> compareToBaseline(const nlohmann::json &baseline, const std::vector<BenchResult> &results,
+                                               double threshold) {
+    std::vector<BenchRegression> regressions;
+    if (!baseline.contains("benchmarks")) {
+        return regressions;
+    }
+    for (const BenchResult &result : results) {
+        for (const auto &entry : baseline["benchmarks"]) {
+            if (entry.value("name", "") != result.name || entry.value("unit", "") != result.unit) {
+                continue;
+            }
+            double baseMedian = entry.value("median", 0.0);
+            if (result.median > baseMedian * (1.0 + threshold) + result.tolerance) {
+                regressions.push_back({result.name, baseMedian, result.median});
+            }
+            break;
+        }
+    }
+    return regressions;
+}
+
+} // namespace Bench
@@ -0,0 +1,260 @@
+#include "Bench/BenchHarness.hpp"
+#include "Engine/Core/ClockManager.hpp"
+#include "Engine/Debug/DebugManager.hpp"
+#include "Engine/World/DeterminismHarness.hpp"
+#include "Engine/World/RegionScheduler.hpp"
+#include "Engine/World/World.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+
+#ifndef BENCH_DEFAULT_BASELINE
+#define BENCH_DEFAULT_BASELINE "bench/baseline.json"
+#endif
+
+static constexpr double SLEEP_OVERSHOOT_TOLERANCE_US = 50.0;
+// Synthetic factories saturate their miners within ~250 ticks; measuring from here keeps samples on comparable work.
+static constexpr int WORLD_SETTLE_TICKS = 300;
+
+static void printUsage(const char *program) {
+    std::cout << "Usage: " << program << " [OPTIONS]\n"
+              << "Options:\n"
+              << "  --baseline PATH     Baseline to compare against; must exist when given\n"
+              << "                      (default " BENCH_DEFAULT_BASELINE ", skipped if missing)\n"
+              << "  --output PATH       Where to write results (default bench_results.json)\n"
+              << "  --threshold FRAC    Allowed median slowdown before failing (default 0.10)\n"
+              << "  --update-baseline   Overwrite the baseline with this run instead of comparing\n"
+              << "  --filter TEXT       Only run benchmarks whose name contains TEXT\n"
+              << "  --samples N         Measured samples per benchmark (default 31)\n"
+              << "  --warmup N          Discarded samples per benchmark (default 5)\n"
+              << "  --core N            Pin the benchmark thread to core N, -1 to disable (default 0)\n";
+}
+
+static const char *buildType() {
+#if defined _RELEASE && defined _DEBUG
+    return "RelWithDebInfo";
+#elif _RELEASE
+    return "Release";
+#else
+    return "Debug";
+#endif
+}
+
+struct WorldWorkload {
+    std::unique_ptr<Engine::World::World> world;
+    std::unique_ptr<Engine::World::World> settled; // restored before every batch
+    std::unique_ptr<Engine::World::RegionScheduler> scheduler;
+};
+
+static WorldWorkload makeWorldWorkload(int size, unsigned threads) {
+    WorldWorkload workload;
+    workload.world = std::make_unique<Engine::World::World>(size, size, 32);
+    Engine::World::buildSyntheticFactory(*workload.world, 1);
+    workload.scheduler = std::make_unique<Engine::World::RegionScheduler>(threads);
+    for (int i = 0; i < WORLD_SETTLE_TICKS; i++) {
+        workload.scheduler->tick(*workload.world);
+    }
+    workload.settled = std::make_unique<Engine::World::World>(*workload.world);
+    return workload;
+}
+
+// Wall-clock overshoot and CPU time of a single precise_sleep call, in microseconds.
+static double sleepOvershootUs(double milliseconds) {
+    auto start = std::chrono::steady_clock::now();
+    CLOCK_MANAGER.precise_sleep(milliseconds);
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    return elapsed - milliseconds * 1000.0;
+}
+static double sleepCpuUs(double milliseconds) {
+    double start = Bench::threadCpuTimeUs();
+    CLOCK_MANAGER.precise_sleep(milliseconds);
+    return Bench::threadCpuTimeUs() - start;
+}
+
+static bool writeJson(const std::string &path, const nlohmann::json &json) {
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    std::error_code error;
+    if (!parent.empty()) {
+        std::filesystem::create_directories(parent, error);
+    }
+    std::ofstream file(path);
+    file << json.dump(2) << "\n";
+    if (!file) {
+        std::cerr << "Failed to write " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    Bench::BenchOptions options;
+    std::string baselinePath = BENCH_DEFAULT_BASELINE;
+    std::string outputPath = "bench_results.json";
+    double threshold = 0.10;
+    bool updateBaseline = false;
+    bool baselineRequired = false; // an explicit --baseline must exist unless we are recording it
+    int core = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--baseline") == 0 && hasValue) {
+            baselinePath = argv[++i];
+            baselineRequired = true;
+        } else if (std::strcmp(arg, "--output") == 0 && hasValue) {
+            outputPath = argv[++i];
+        } else if (std::strcmp(arg, "--threshold") == 0 && hasValue) {
+            threshold = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--update-baseline") == 0) {
+            updateBaseline = true;
+        } else if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--samples") == 0 && hasValue) {
+            options.samples = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--warmup") == 0 && hasValue) {
+            options.warmupSamples = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--core") == 0 && hasValue) {
+            core = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "-h") == 0 || std::strcmp(arg, "--help") == 0) {
+            printUsage(argv[0]);
+            return EXIT_SUCCESS;
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    // EngineClock reads glfwGetTime, which needs an initialized library but no display or GPU.
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit()) {
+        std::cerr << "Failed to initialize GLFW (null platform)\n";
+        return 2;
+    }
+    Engine::Core::ClockManager::GetInstance();
+
+    // Schedulers spawn their workers before the main thread is pinned so the workers keep the full affinity mask.
+    const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    WorldWorkload small = makeWorldWorkload(128, 1);
+    WorldWorkload large = makeWorldWorkload(256, 1);
+    WorldWorkload largeParallel;
+    if (hardwareThreads > 1) {
+        largeParallel = makeWorldWorkload(256, hardwareThreads);
+    }
+
+    bool pinned = core >= 0 && Bench::pinThreadToCore(core);
+    if (core >= 0 && !pinned) {
+        std::cerr << "warning: could not pin to core " << core << ", running unpinned\n";
+    }
+
+    Bench::BenchHarness harness(options);
+
+    harness.run("clock/UpdateClocks", [](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            CLOCK_MANAGER.UpdateClocks();
+        }
+    });
+    for (double ms : {0.5, 1.0, 5.0}) {
+        std::string suffix = std::to_string(ms).substr(0, 3) + "ms";
+        // Overshoot sits near zero when precise_sleep works; only tens of microseconds late is worth failing on.
+        harness.runMeasured("clock/precise_sleep_" + suffix + "/overshoot", "us", [ms] { return sleepOvershootUs(ms); },
+                            SLEEP_OVERSHOOT_TOLERANCE_US);
+        harness.runMeasured("clock/precise_sleep_" + suffix + "/cpu", "us", [ms] { return sleepCpuUs(ms); });
+    }
+
+    harness.run("debug/incrementCounter", [](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            DEBUG_INCREMENT("bench_counter");
+        }
+    });
+    harness.run("debug/setCounter", [](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            DEBUG_SET_COUNTER("bench_counter", static_cast<int>(i));
+        }
+    });
+    harness.run("debug/startEndTimer", [](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            DEBUG_START_TIMER("bench_timer");
+            DEBUG_END_TIMER("bench_timer");
+        }
+    });
+    harness.run("debug/updateFPS", [](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            DEBUG_FPS(1.0f / 240.0f);
+        }
+    });
+
+    auto tickWorkload = [](WorldWorkload &workload) {
+        return [&workload](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) {
+                workload.scheduler->tick(*workload.world);
+            }
+        };
+    };
+    auto resetWorkload = [](WorldWorkload &workload) {
+        return [&workload] { *workload.world = *workload.settled; };
+    };
+    harness.run("world/tick_128x128_1t", tickWorkload(small), resetWorkload(small));
+    harness.run("world/tick_256x256_1t", tickWorkload(large), resetWorkload(large));
+    if (largeParallel.world) {
+        harness.run("world/tick_256x256_" + std::to_string(hardwareThreads) + "t", tickWorkload(largeParallel),
+                    resetWorkload(largeParallel));
+    }
+    glfwTerminate();
+
+    nlohmann::json report = harness.toJson();
+    report["build_type"] = buildType();
+    report["hardware_threads"] = hardwareThreads;
+    report["pinned_core"] = pinned ? core : -1;
+
+    if (!writeJson(outputPath, report)) {
+        return 2;
+    }
+    std::cout << "results written to " << outputPath << "\n";
+
+    if (updateBaseline) {
+        if (!writeJson(baselinePath, report)) {
+            return 2;
+        }
+        std::cout << "baseline updated: " << baselinePath << "\n";
+        return EXIT_SUCCESS;
+    }
+
+    std::ifstream baselineFile(baselinePath);
+    if (!baselineFile) {
+        if (baselineRequired) {
+            std::cerr << "Baseline " << baselinePath << " does not exist; record one with --update-baseline\n";
+            return 2;
+        }
+        std::cout << "no baseline at " << baselinePath << ", skipping regression check\n";
+        return EXIT_SUCCESS;
+    }
+    nlohmann::json baseline = nlohmann::json::parse(baselineFile, nullptr, false);
+    if (baseline.is_discarded()) {
+        std::cerr << "Baseline " << baselinePath << " is not valid JSON\n";
+        return 2;
+    }
+    if (baseline.value("build_type", "") != buildType()) {
+        std::cout << "warning: baseline was recorded in " << baseline.value("build_type", "?") << " mode, this is "
+                  << buildType() << "\n";
+    }
+
+    auto regressions = Bench::compareToBaseline(baseline, harness.getResults(), threshold);
+    for (const auto &regression : regressions) {
+        std::cout << "REGRESSION " << regression.name << ": " << regression.baselineMedian << " -> "
+                  << regression.currentMedian << " (+"
+                  << (regression.currentMedian / regression.baselineMedian - 1.0) * 100.0 << "%)\n";
+    }
+    if (!regressions.empty()) {
+        return EXIT_FAILURE;
+    }
+    std::cout << "no regressions beyond " << threshold * 100.0 << "% against " << baselinePath << "\n";
+    return EXIT_SUCCESS;
+}
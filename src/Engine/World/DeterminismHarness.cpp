@@ -0,0 +1,58 @@
+#include "Engine/World/DeterminismHarness.hpp"
+#include "Engine/World/RegionScheduler.hpp"
+#include <chrono>
+#include <random>
+
+namespace Engine::World {
+
+void buildSyntheticFactory(World &world, uint32_t seed) {
+    // Use the raw engine output rather than std::uniform_int_distribution, whose results are implementation-defined.
+    std::mt19937 rng(seed);
+    for (int y = 0; y < world.getHeight(); y++) {
+        for (int x = 0; x < world.getWidth(); x++) {
+            Tile tile;
+            uint32_t roll = rng() % 100;
+            if (roll < 10) {
+                tile.kind = EntityKind::Miner;
+            } else if (roll < 60) {
+                tile.kind = EntityKind::Belt;
+            } else if (roll < 65) {
+                tile.kind = EntityKind::Chest;
+            }
+            tile.dir = static_cast<Direction>(rng() % 4);
+            world.setTile(x, y, tile);
+        }
+    }
+}
+
+std::vector<DeterminismResult> runDeterminismCheck(const DeterminismConfig &config) {
+    std::vector<DeterminismResult> results;
+    results.reserve(config.threadCounts.size());
+
+    for (unsigned threadCount : config.threadCounts) {
+        World world(config.width, config.height, config.regionSize);
+        buildSyntheticFactory(world, config.seed);
+        RegionScheduler scheduler(threadCount);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < config.ticks; i++) {
+            scheduler.tick(world);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        results.push_back({scheduler.getThreadCount(), world.computeStateHash(),
+                           std::chrono::duration<double, std::milli>(end - start).count()});
+    }
+    return results;
+}
+
+bool hashesMatch(const std::vector<DeterminismResult> &results) {
+    for (const DeterminismResult &result : results) {
+        if (result.stateHash != results.front().stateHash) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace Engine::World
@@ -0,0 +1,94 @@
+#include "Engine/World/RegionScheduler.hpp"
+
+namespace Engine::World {
+
+RegionScheduler::RegionScheduler(unsigned threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+    workers.reserve(threadCount - 1);
+    for (unsigned i = 1; i < threadCount; i++) {
+        workers.emplace_back(&RegionScheduler::workerLoop, this);
+    }
+};
+
+RegionScheduler::~RegionScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workReady.notify_all();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+};
+
+void RegionScheduler::updateRegions() {
+    const size_t regionCount = commandBuffers.size();
+    for (size_t region = nextRegion.fetch_add(1); region < regionCount; region = nextRegion.fetch_add(1)) {
+        activeWorld->updateRegion(region, commandBuffers[region]);
+    }
+}
+
+void RegionScheduler::workerLoop() {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workReady.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = generation;
+        }
+
+        updateRegions();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busyWorkers--;
+        }
+        workDone.notify_one();
+    }
+}
+
+void RegionScheduler::tick(World &world) {
+    commandBuffers.resize(world.getRegionCount());
+    for (CommandBuffer &buffer : commandBuffers) {
+        buffer.clear();
+    }
+
+    // Update phase
+    if (workers.empty()) {
+        activeWorld = &world;
+        nextRegion = 0;
+        updateRegions();
+    } else {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            activeWorld = &world;
+            nextRegion = 0;
+            busyWorkers = static_cast<unsigned>(workers.size());
+            generation++;
+        }
+        workReady.notify_all();
+        updateRegions();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        workDone.wait(lock, [this] { return busyWorkers == 0; });
+    }
+    activeWorld = nullptr;
+
+    // Commit phase
+    lastCommandCount = 0;
+    for (const CommandBuffer &buffer : commandBuffers) {
+        world.applyCommands(buffer);
+        lastCommandCount += buffer.size();
+    }
+    world.endTick();
+}
+
+} // namespace Engine::World
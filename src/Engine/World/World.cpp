@@ -0,0 +1,136 @@
+#include "Engine/World/World.hpp"
+#include <stdexcept>
+
+namespace Engine::World {
+
+World::World(int width, int height, int regionSize) : width(width), height(height), regionSize(regionSize) {
+    if (width <= 0 || height <= 0 || regionSize <= 0) {
+        throw std::invalid_argument("World dimensions and region size must be positive");
+    }
+    regionsX = (width + regionSize - 1) / regionSize;
+    regionsY = (height + regionSize - 1) / regionSize;
+    tiles.resize(static_cast<size_t>(width) * height);
+};
+
+uint16_t World::capacityOf(EntityKind kind) {
+    switch (kind) {
+    case EntityKind::Miner:
+        return MINER_CAPACITY;
+    case EntityKind::Belt:
+        return BELT_CAPACITY;
+    case EntityKind::Chest:
+        return CHEST_CAPACITY;
+    default:
+        return 0;
+    }
+}
+
+void World::pushItem(int x, int y, size_t region, CommandBuffer &deferred) {
+    int tx = x, ty = y;
+    switch (getTile(x, y).dir) {
+    case Direction::North:
+        ty--;
+        break;
+    case Direction::East:
+        tx++;
+        break;
+    case Direction::South:
+        ty++;
+        break;
+    case Direction::West:
+        tx--;
+        break;
+    }
+    if (tx < 0 || ty < 0 || tx >= width || ty >= height) {
+        return;
+    }
+
+    if (regionOf(tx, ty) != region) {
+        // The target belongs to another region that may be updating right now; decide at commit time.
+        deferred.pushTransfer(static_cast<uint32_t>(tileIndex(x, y)), static_cast<uint32_t>(tileIndex(tx, ty)));
+        return;
+    }
+
+    Tile &target = getTile(tx, ty);
+    if (target.items + target.incoming < capacityOf(target.kind)) {
+        getTile(x, y).items--;
+        target.incoming++;
+    }
+}
+
+void World::updateRegion(size_t region, CommandBuffer &deferred) {
+    int x0 = static_cast<int>(region % regionsX) * regionSize;
+    int y0 = static_cast<int>(region / regionsX) * regionSize;
+    int x1 = x0 + regionSize < width ? x0 + regionSize : width;
+    int y1 = y0 + regionSize < height ? y0 + regionSize : height;
+
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            Tile &tile = getTile(x, y);
+            switch (tile.kind) {
+            case EntityKind::Miner:
+                // A full miner stalls instead of counting on, so its timer cannot wrap while blocked.
+                if (tile.items < MINER_CAPACITY && ++tile.timer >= MINER_PERIOD) {
+                    tile.timer = 0;
+                    tile.items++;
+                }
+                if (tile.items > 0) {
+                    pushItem(x, y, region, deferred);
+                }
+                break;
+            case EntityKind::Belt:
+                if (tile.items > 0) {
+                    pushItem(x, y, region, deferred);
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    // Items moved inside the region only become visible once every tile in it has updated, so an item advances at
+    // most one tile per tick regardless of scan order.
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            Tile &tile = getTile(x, y);
+            tile.items += tile.incoming;
+            tile.incoming = 0;
+        }
+    }
+}
+
+void World::applyCommands(const CommandBuffer &deferred) {
+    for (const WorldCommand &command : deferred.getCommands()) {
+        Tile &from = tiles[command.fromTile];
+        Tile &to = tiles[command.toTile];
+        if (from.items > 0 && to.items < capacityOf(to.kind)) {
+            from.items--;
+            to.items++;
+        }
+    }
+}
+
+uint64_t World::computeStateHash() const {
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    uint64_t hash = FNV_OFFSET;
+    auto mix = [&hash](uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; i++) {
+            hash ^= (value >> (i * 8)) & 0xff;
+            hash *= FNV_PRIME;
+        }
+    };
+
+    mix(tickCount, 8);
+    for (const Tile &tile : tiles) {
+        mix(static_cast<uint8_t>(tile.kind), 1);
+        mix(static_cast<uint8_t>(tile.dir), 1);
+        mix(tile.items, 2);
+        mix(tile.timer, 2);
+    }
+    return hash;
+}
+
+} // namespace Engine::World
@@ -1,14 +1,43 @@
 #include "Engine/Core/ClockManager.hpp"
 #include "Engine/Core/Window.hpp"
 #include "Engine/Debug/DebugManager.hpp"
+#include "Engine/World/DeterminismHarness.hpp"
+#include "Engine/World/RegionScheduler.hpp"
+#include "Engine/World/World.hpp"
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <stdlib.h>
+#include <thread>
 
 static constexpr double TICK_RATE = 20.0;
 static constexpr double TICK_DT = 1.0 / TICK_RATE;
+static constexpr int WORLD_SIZE = 256;
+static constexpr int WORLD_REGION_SIZE = 32;
 
-int main() {
+// Runs the synthetic factory at several thread counts and fails if any final state hash differs.
+static int runDeterminismCheck() {
+    Engine::World::DeterminismConfig config;
+    config.threadCounts.push_back(std::thread::hardware_concurrency());
+    auto results = Engine::World::runDeterminismCheck(config);
+
+    for (const auto &result : results) {
+        std::cout << "threads " << std::setw(3) << result.threadCount << "  hash 0x" << std::hex << std::setw(16)
+                  << std::setfill('0') << result.stateHash << std::dec << std::setfill(' ') << "  " << std::fixed
+                  << std::setprecision(2) << result.elapsedMs << "ms\n";
+    }
+    if (!Engine::World::hashesMatch(results)) {
+        std::cout << "determinism check FAILED\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "determinism check passed\n";
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && std::strcmp(argv[1], "--determinism-check") == 0) {
+        return runDeterminismCheck();
+    }
 #ifdef _WIN32
     TimerRAII timer_guard(1);
 #endif
@@ -22,13 +51,20 @@ int main() {
     Engine::Core::ClockManager::GetInstance();
     Engine::Window window(800, 600, "Factory Game");
 
-    double tick_lag;
+    Engine::World::World world(WORLD_SIZE, WORLD_SIZE, WORLD_REGION_SIZE);
+    Engine::World::buildSyntheticFactory(world, 1);
+    Engine::World::RegionScheduler scheduler;
+
+    double tick_lag = 0.0;
     while (!window.shouldClose()) {
         CLOCK_MANAGER.UpdateClocks();
         window.pollEvents();
 
         tick_lag += CLOCK_MANAGER.GameClock->getStartTime() - CLOCK_MANAGER.GameClock->getLastTime();
         while (tick_lag >= TICK_DT) {
+            DEBUG_START_TIMER("world_tick");
+            scheduler.tick(world);
+            DEBUG_END_TIMER("world_tick");
             tick_lag -= TICK_DT;
         }
 